@@ -283,8 +283,25 @@ void *thread_recepcao(void *arg) {
 
             case MSG_EQUIPE_DRONE: {
                 payload_equipe_drone_t *pay = (payload_equipe_drone_t *)(buffer + sizeof(header_t));
+                size_t tam_payload = ntohs(header->tamanho);
+
+                // Payload de tamanho variável: valida antes de ler a rota
+                if (tam_payload < TAMANHO_EQUIPE_DRONE(0) || n < sizeof(header_t) + tam_payload ||
+                    pay->num_saltos < 1 || pay->num_saltos > MAX_CIDADES ||
+                    tam_payload != TAMANHO_EQUIPE_DRONE(pay->num_saltos)) {
+                    printf("  [AVISO] Ordem de drone malformada descartada.\n");
+                    break;
+                }
+
                 printf("\n[ORDEM RECEBIDA] Equipe %d designada para cidade %d\n", 
                        pay->id_equipe, pay->id_cidade);
+                printf("  Rota (%d km, ETA %d min):", pay->distancia_km, pay->eta_minutos);
+                for (int i = 0; i < pay->num_saltos; i++) {
+                    int id = pay->rota[i];
+                    const char *nome = (id >= 0 && id < MAX_CIDADES) ? lista_cidades[id].nome : "?";
+                    printf("%s %s", i ? " ->" : "", nome);
+                }
+                printf("\n");
 
                 // Envia ACK da ordem (Protocolo)
                 header_t h_ack = { htons(MSG_ACK), htons(sizeof(payload_ack_t)) };
@@ -10,6 +10,7 @@
 #include <arpa/inet.h>
 #include <pthread.h>
 #include <unistd.h> 
+#include <stddef.h>
 
 #define MSG_TELEMETRIA     1 // Cliente envia estado das cidades
 #define MSG_ACK            2 // Confirmação de recebimento
@@ -45,11 +46,21 @@ typedef struct {
     int status; 
 } payload_ack_t;
 
+// Ordem de despacho (tamanho variável): só os 'num_saltos' primeiros
+// elementos de 'rota' são transmitidos. A rota vai da capital da equipe
+// (rota[0]) até a cidade em alerta (rota[num_saltos - 1]).
 typedef struct {
     int id_cidade; 
     int id_equipe; 
+    int distancia_km;            // Distância total da rota
+    int eta_minutos;             // Tempo estimado de chegada
+    int num_saltos;              // Quantidade de cidades em 'rota'
+    int rota[MAX_CIDADES];       // IDs das cidades, salto a salto
 } payload_equipe_drone_t;
 
+// Tamanho em bytes do payload de despacho com 'n' cidades na rota
+#define TAMANHO_EQUIPE_DRONE(n) (offsetof(payload_equipe_drone_t, rota) + (n) * sizeof(int))
+
 typedef struct {
     int id_cidade; 
     int id_equipe; 
@@ -16,6 +16,11 @@ int num_arestas;
 // 0 = Livre, 1 = Ocupada
 int equipe_ocupada[MAX_CIDADES];
 
+// Árvores de caminhos mínimos mantidas em cache (uma por cidade de origem)
+#define TAMANHO_CACHE_ARVORES  8
+// Velocidade média de cruzeiro dos drones, usada no cálculo do ETA
+#define VELOCIDADE_DRONE_KMH   120
+
 void inicializar_grafo() {
     for (int i = 0; i < MAX_CIDADES; i++) {
         for (int j = 0; j < MAX_CIDADES; j++) {
@@ -69,15 +74,16 @@ void carregar_grafo(const char *filename) {
 
 // =========================================================
 // ALGORITMO DE DIJKSTRA
-// Retorna o ID da equipe (Capital) mais proxima disponivel
+// Calcula a árvore de caminhos mínimos a partir de 'origem'
+// (distâncias e predecessores de cada cidade)
 // =========================================================
-int encontrar_drone_mais_proximo(int origem) {
-    int dist[MAX_CIDADES];
+void calcular_arvore(int origem, int dist[], int pred[]) {
     int visitado[MAX_CIDADES];
     
     // Inicialização
     for (int i = 0; i < MAX_CIDADES; i++) {
         dist[i] = INT_MAX;
+        pred[i] = -1;
         visitado[i] = 0;
     }
     dist[origem] = 0;
@@ -103,9 +109,65 @@ int encontrar_drone_mais_proximo(int origem) {
             if (!visitado[v] && adj[u][v] != -1 && dist[u] != INT_MAX &&
                 dist[u] + adj[u][v] < dist[v]) {
                 dist[v] = dist[u] + adj[u][v];
+                pred[v] = u;
             }
         }
     }
+}
+
+// =========================================================
+// CACHE LRU DE ÁRVORES DE CAMINHOS MÍNIMOS
+// O grafo não muda depois de carregado, então a árvore de uma
+// origem vale para sempre; só a disponibilidade das equipes é
+// verificada a cada alerta.
+// =========================================================
+typedef struct {
+    int origem;                 // -1 = slot vazio
+    unsigned long ultimo_uso;   // Marca de tempo lógica para o LRU
+    int dist[MAX_CIDADES];
+    int pred[MAX_CIDADES];
+} arvore_cache_t;
+
+arvore_cache_t cache_arvores[TAMANHO_CACHE_ARVORES];
+unsigned long relogio_cache = 0;
+
+void inicializar_cache() {
+    for (int i = 0; i < TAMANHO_CACHE_ARVORES; i++) {
+        cache_arvores[i].origem = -1;
+        cache_arvores[i].ultimo_uso = 0;
+    }
+}
+
+// Retorna a árvore de 'origem', calculando-a (e expulsando a
+// entrada menos usada recentemente) se ainda não estiver no cache
+arvore_cache_t *obter_arvore(int origem) {
+    int vitima = 0;
+
+    for (int i = 0; i < TAMANHO_CACHE_ARVORES; i++) {
+        if (cache_arvores[i].origem == origem) {
+            cache_arvores[i].ultimo_uso = ++relogio_cache;
+            return &cache_arvores[i];
+        }
+        // Slot vazio tem ultimo_uso = 0, então é escolhido antes dos ocupados
+        if (cache_arvores[i].ultimo_uso < cache_arvores[vitima].ultimo_uso) {
+            vitima = i;
+        }
+    }
+
+    arvore_cache_t *arvore = &cache_arvores[vitima];
+    calcular_arvore(origem, arvore->dist, arvore->pred);
+    arvore->origem = origem;
+    arvore->ultimo_uso = ++relogio_cache;
+    return arvore;
+}
+
+// =========================================================
+// ESCOLHA DA EQUIPE
+// Retorna o ID da equipe (Capital) mais proxima disponivel e
+// preenche 'ordem' com a rota salto a salto e o ETA
+// =========================================================
+int encontrar_drone_mais_proximo(int origem, payload_equipe_drone_t *ordem) {
+    arvore_cache_t *arvore = obter_arvore(origem);
 
     // Agora buscamos a Capital mais proxima que esteja LIVRE
     int melhor_equipe = -1;
@@ -115,20 +177,37 @@ int encontrar_drone_mais_proximo(int origem) {
         // Verifica se é capital (tipo 1) e se a equipe está livre
         if (cidades[i].tipo == 1) {
             if (equipe_ocupada[i] == 0) {
-                if (dist[i] < menor_distancia) {
-                    menor_distancia = dist[i];
+                if (arvore->dist[i] < menor_distancia) {
+                    menor_distancia = arvore->dist[i];
                     melhor_equipe = i;
                 }
             }
         }
     }
 
-    if (melhor_equipe != -1) {
-        printf("  > Dijkstra: Melhor equipe p/ %s é %s (%d km)\n", 
-               cidades[origem].nome, cidades[melhor_equipe].nome, menor_distancia);
-    } else {
+    if (melhor_equipe == -1) {
         printf("  > Dijkstra: Nenhuma equipe disponivel!\n");
+        return -1;
+    }
+
+    // A árvore tem raiz na cidade em alerta: seguir os predecessores
+    // a partir da capital já dá a rota no sentido do voo
+    ordem->id_cidade = origem;
+    ordem->id_equipe = melhor_equipe;
+    ordem->distancia_km = menor_distancia;
+    ordem->eta_minutos = (menor_distancia * 60 + VELOCIDADE_DRONE_KMH - 1) / VELOCIDADE_DRONE_KMH;
+    ordem->num_saltos = 0;
+    for (int v = melhor_equipe; v != -1; v = arvore->pred[v]) {
+        ordem->rota[ordem->num_saltos++] = v;
+    }
+
+    printf("  > Dijkstra: Melhor equipe p/ %s é %s (%d km, ETA %d min)\n", 
+           cidades[origem].nome, cidades[melhor_equipe].nome, menor_distancia, ordem->eta_minutos);
+    printf("  > Rota:");
+    for (int i = 0; i < ordem->num_saltos; i++) {
+        printf("%s %s", i ? " ->" : "", cidades[ordem->rota[i]].nome);
     }
+    printf("\n");
 
     return melhor_equipe;
 }
@@ -138,6 +217,7 @@ int encontrar_drone_mais_proximo(int origem) {
 // =========================================================
 int main(int argc, char *argv[]) {
     inicializar_grafo();
+    inicializar_cache();
     carregar_grafo("grafo_amazonia_legal.txt");
 
     int sockfd = socket(AF_INET, SOCK_DGRAM, 0);
@@ -190,26 +270,23 @@ int main(int argc, char *argv[]) {
                         int id_cidade = payload->dados[i].id_cidade;
                         printf("  ! ALERTA DETECTADO EM: %s (ID %d)\n", cidades[id_cidade].nome, id_cidade);
                         
-                        // Rodar Dijkstra
-                        int id_equipe = encontrar_drone_mais_proximo(id_cidade);
+                        // Rodar Dijkstra (ou reaproveitar árvore do cache)
+                        payload_equipe_drone_t drone_payload;
+                        int id_equipe = encontrar_drone_mais_proximo(id_cidade, &drone_payload);
 
                         if (id_equipe != -1) {
                             // Marca equipe como ocupada
                             equipe_ocupada[id_equipe] = 1;
 
-                            // Envia ordem de Drone
-                            header_t drone_header = { htons(MSG_EQUIPE_DRONE), htons(sizeof(payload_equipe_drone_t)) };
-                            payload_equipe_drone_t drone_payload;
-                            drone_payload.id_cidade = id_cidade;
-                            
-                            // *** CORREÇÃO AQUI: removido o label estranho ***
-                            drone_payload.id_equipe = id_equipe;
+                            // Envia ordem de Drone (só a parte usada da rota)
+                            size_t tam_payload = TAMANHO_EQUIPE_DRONE(drone_payload.num_saltos);
+                            header_t drone_header = { htons(MSG_EQUIPE_DRONE), htons(tam_payload) };
 
                             char drone_buf[sizeof(header_t) + sizeof(payload_equipe_drone_t)];
                             memcpy(drone_buf, &drone_header, sizeof(header_t));
-                            memcpy(drone_buf + sizeof(header_t), &drone_payload, sizeof(payload_equipe_drone_t));
+                            memcpy(drone_buf + sizeof(header_t), &drone_payload, tam_payload);
 
-                            sendto(sockfd, drone_buf, sizeof(drone_buf), 0, (struct sockaddr *)&client_addr, client_len);
+                            sendto(sockfd, drone_buf, sizeof(header_t) + tam_payload, 0, (struct sockaddr *)&client_addr, client_len);
                             printf("  -> Ordem enviada: Equipe %s despachada.\n", cidades[id_equipe].nome);
                         }
                     }